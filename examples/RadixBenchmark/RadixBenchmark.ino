@@ -0,0 +1,48 @@
+/*
+ShiftDisplay2 example
+by Ameer Dawood
+Compare time to set decimal and hexadecimal/octal/binary numbers, printed on Serial Monitor (250000 baud)
+https://ameer.io/ShiftDisplay2/
+*/
+
+#include <ShiftDisplay2.h>
+
+const DisplayType DISPLAY_TYPE = COMMON_CATHODE; // COMMON_CATHODE or COMMON_ANODE
+const int DISPLAY_SIZE = 8; // number of digits on display
+const long VALUE = 0x12345678; // register dump
+const int REPETITIONS = 1000;
+
+ShiftDisplay2 display(DISPLAY_TYPE, DISPLAY_SIZE);
+
+unsigned long measureDecimal() {
+	unsigned long start = micros();
+	for (int i = 0; i < REPETITIONS; i++)
+		display.set(VALUE + i);
+	return micros() - start;
+}
+
+unsigned long measureRadix(Radix radix) {
+	unsigned long start = micros();
+	for (int i = 0; i < REPETITIONS; i++)
+		display.set(VALUE + i, radix);
+	return micros() - start;
+}
+
+void setup() {
+	Serial.begin(250000);
+	Serial.print("decimal: ");
+	Serial.println(measureDecimal() / REPETITIONS);
+	Serial.print("hexadecimal: ");
+	Serial.println(measureRadix(RADIX_HEX) / REPETITIONS);
+	Serial.print("octal: ");
+	Serial.println(measureRadix(RADIX_OCT) / REPETITIONS);
+	Serial.print("binary: ");
+	Serial.println(measureRadix(RADIX_BIN) / REPETITIONS);
+	Serial.println("microseconds per set()");
+
+	display.set(VALUE, RADIX_HEX, true); // show 12345678 with leading zeros
+}
+
+void loop() {
+	display.update();
+}
@@ -14,6 +14,7 @@ enum sections { // in order of connection
 };
 const int SECTION_SIZES[] = {3, 4, 1, 0};
 const int RESERVE = 0; // digit index relative to FUEL_GAUGE
+const auto GREETING PROGMEM = encodeText("lets go"); // encoded when compiling, stored in flash
 
 ShiftDisplay2 dashboard(COMMON_CATHODE, SECTION_SIZES);
 
@@ -34,7 +35,7 @@ bool inReserve() {
 }
 
 void setup() {
-	dashboard.set("lets go");
+	dashboard.set(inFlash(GREETING)); // read from flash
 	while (millis() < 2000 || getSpeed() == 0)
 		dashboard.update();
 }
@@ -0,0 +1,33 @@
+/*
+ShiftDisplay2 example
+by Ameer Dawood
+Three displays on the same clock and data pins, two of them showing the same value
+https://ameer.io/ShiftDisplay2/
+*/
+
+#include <ShiftDisplay2.h>
+
+// Arduino pin 7 connected to clock of all shift registers, pin 5 to data of all shift registers
+ShiftBus bus(7, 5);
+
+// pin 6 connected to latch of first display, pin 8 to latch of second display
+ShiftDisplay2 score(bus, 6, COMMON_CATHODE, 4);
+ShiftDisplay2 timerDisplay(bus, 8, COMMON_CATHODE, 4);
+SectionTime timer(timerDisplay, 0, TIME_MM_SS);
+
+unsigned long lastSecond = 0; // millis when timer last changed
+
+void setup() {
+	score.addMirror(9); // pin 9 connected to latch of a third display, a copy of score for the audience
+	score.set(42);
+	timer.setDuration(90000); // 01.30
+}
+
+void loop() {
+	score.update(); // shift once, show on both score displays
+	timerDisplay.update();
+	if (millis() - lastSecond >= 1000) { // independent of time taken by updates
+		lastSecond += 1000;
+		timer.decrement();
+	}
+}
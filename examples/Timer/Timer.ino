@@ -14,6 +14,7 @@ const int BUTTON_PIN = 2; // connect one end of button to pin 2 and other to gro
 volatile bool buttonPressed;
 
 ShiftDisplay2 display(DISPLAY_TYPE, DISPLAY_SIZE);
+SectionTime timer(display, 0, TIME_SS_T); // seconds with one decimal place
 
 void debounce() {
 	display.show(100); // execution will delay for 100ms
@@ -32,9 +33,8 @@ void setup() {
 void loop() {
 
 	// start
-	float n;
-	for (float i = 600; i > 0; i--) {
-		n = i / 10;
+	timer.setDuration(60000);
+	for (int i = 600; i > 0; i--) {
 		if (buttonPressed) {
 
 			// pause
@@ -47,8 +47,8 @@ void loop() {
 			debounce();
 			buttonPressed = false;
 		}
-		display.set(n, 1); // float with one decimal place
 		display.show(100);
+		timer.decrement(); // one tenth of second less
 	}
 
 	// finished
@@ -8,9 +8,13 @@ https://ameer.io/ShiftDisplay2/
 #ifndef CharacterEncoding_h
 #define CharacterEncoding_h
 
+// internal to the library, sketches only use encodeText(), inFlash() and their types
+
+namespace ShiftDisplay2Detail {
+
 // encoding for character segments in abcdefgp format (common cathode, LSBFIRST)
 
-const byte NUMBERS[] = {
+constexpr byte NUMBERS[] = {
 	//ABCDEFG
 	 B11111100, // 0
 	 B01100000, // 1
@@ -24,7 +28,7 @@ const byte NUMBERS[] = {
 	 B11110110  // 9
 };
 
-const byte LETTERS[] = {
+constexpr byte LETTERS[] = {
 	//ABCDEFG
 	 B11101110, // a
 	 B00111110, // b
@@ -54,8 +58,8 @@ const byte LETTERS[] = {
 	 B11011010  // z
 };
 
-const byte MINUS = B00000010;
-const byte EMPTY = B00000000;
+constexpr byte MINUS = B00000010;
+constexpr byte EMPTY = B00000000;
 
 // encoding for display indexes (common anode, LSBFIRST)
 
@@ -70,4 +74,57 @@ const byte INDEXES[] = {
 	B00000001  // 7
 };
 
+// single source of character encoding, used by encodeText() when compiling and by the display at runtime
+constexpr byte encodeCharacter(char c) {
+	return c >= '0' && c <= '9' ? NUMBERS[c - '0'] :
+		c >= 'a' && c <= 'z' ? LETTERS[c - 'a'] :
+		c >= 'A' && c <= 'Z' ? LETTERS[c - 'A'] :
+		c == '-' ? MINUS :
+		EMPTY; // space or invalid
+}
+
+template<int... I>
+struct EncodedIndexes {};
+
+template<int N, int... I>
+struct MakeEncodedIndexes : MakeEncodedIndexes<N - 1, N - 1, I...> {};
+
+template<int... I>
+struct MakeEncodedIndexes<0, I...> {
+	typedef EncodedIndexes<I...> type;
+};
+
+} // namespace ShiftDisplay2Detail
+
+// compile time encoding of string literals, in abcdefgp format (common cathode, LSBFIRST)
+// eg: const auto GREETING = encodeText("hello");
+// or in flash: const auto GREETING PROGMEM = encodeText("hello"); then use inFlash(GREETING)
+
+template<int N>
+struct EncodedText {
+	static_assert(N > 0, "encoded text needs at least one character");
+	byte codes[N];
+};
+
+template<int N>
+struct FlashEncodedText { // EncodedText stored in flash with PROGMEM
+	const EncodedText<N> *text;
+};
+
+template<int N>
+constexpr FlashEncodedText<N> inFlash(const EncodedText<N> &text) { // text must be declared with PROGMEM
+	return FlashEncodedText<N>{ &text };
+}
+
+template<int N, int... I>
+constexpr EncodedText<N - 1> encodeText(const char (&text)[N], ShiftDisplay2Detail::EncodedIndexes<I...>) {
+	return EncodedText<N - 1>{ { ShiftDisplay2Detail::encodeCharacter(text[I])... } };
+}
+
+template<int N>
+constexpr EncodedText<N - 1> encodeText(const char (&text)[N]) { // N counts null terminator
+	static_assert(N > 1, "encodeText() needs at least one character");
+	return encodeText(text, typename ShiftDisplay2Detail::MakeEncodedIndexes<N - 1>::type());
+}
+
 #endif
@@ -7,53 +7,85 @@ https://ameer.io/ShiftDisplay2/
 
 #include "Arduino.h"
 #include "ShiftDisplay2.h"
-#include "CharacterEncoding.h"
+
+using namespace ShiftDisplay2Detail;
+
+const byte PRINT_DOT = B10000000; // flag on a printed character followed by a dot
+
+// time fields of each TimeFormat, least significant first
+const int TIME_FIELD_COUNTS[] = { 2, 2, 3, 2 };
+const byte TIME_LIMITS[][3] = { // exclusive maximum of each field, in BCD
+	{ 0x60, 0x24, 0x00 }, // TIME_HH_MM
+	{ 0x60, 0xA0, 0x00 }, // TIME_MM_SS
+	{ 0x60, 0x60, 0x24 }, // TIME_HH_MM_SS
+	{ 0x10, 0xA0, 0x00 }  // TIME_SS_T
+};
 
 // CONSTRUCTORS ****************************************************************
 
-ShiftDisplay2::ShiftDisplay2(DisplayType displayType, int displaySize, DisplayDrive displayDrive) {
+ShiftDisplay2::ShiftDisplay2(DisplayType displayType, int displaySize, DisplayDrive displayDrive, const int segments[]) {
 	int sectionSizes[] = {displaySize, 0}; // single section with size of display
-	construct(DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES);
+	construct(NULL, DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive) {
+ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive, const int segments[]) {
 	int sectionSizes[] = {displaySize, 0}; // single section with size of display
-	construct(latchPin, clockPin, dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES);
+	construct(NULL, latchPin, clockPin, dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive) {
-	construct(DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES);
+ShiftDisplay2::ShiftDisplay2(DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, const int segments[]) {
+	construct(NULL, DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive) {
-	construct(latchPin, clockPin, dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES);
+ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, const int segments[]) {
+	construct(NULL, latchPin, clockPin, dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[]) {
+ShiftDisplay2::ShiftDisplay2(DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[], const int segments[]) {
 	int sectionSizes[] = {displaySize, 0}; // single section with size of display
-	construct(DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes);
+	construct(NULL, DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
+}
+
+ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[], const int segments[]) {
+	int sectionSizes[] = {displaySize, 0}; // single section with size of display
+	construct(NULL, latchPin, clockPin, dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
+}
+
+ShiftDisplay2::ShiftDisplay2(DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[], const int segments[]) {
+	construct(NULL, DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
+}
+
+ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[], const int segments[]) {
+	construct(NULL, latchPin, clockPin, dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[]) {
+ShiftDisplay2::ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive, const int segments[]) {
 	int sectionSizes[] = {displaySize, 0}; // single section with size of display
-	construct(latchPin, clockPin, dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes);
+	construct(&bus, latchPin, bus._clockPin, bus._dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[]) {
-	construct(DEFAULT_LATCH_PIN, DEFAULT_CLOCK_PIN, DEFAULT_DATA_PIN, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes);
+ShiftDisplay2::ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, const int segments[]) {
+	construct(&bus, latchPin, bus._clockPin, bus._dataPin, displayType, sectionSizes, displayDrive, false, DEFAULT_INDEXES, segments);
 }
 
-ShiftDisplay2::ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[]) {
-	construct(latchPin, clockPin, dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes);
+ShiftDisplay2::ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[], const int segments[]) {
+	int sectionSizes[] = {displaySize, 0}; // single section with size of display
+	construct(&bus, latchPin, bus._clockPin, bus._dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
 }
 
-void ShiftDisplay2::construct(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, bool swappedShiftRegisters, const int indexes[]) {
+ShiftDisplay2::ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[], const int segments[]) {
+	construct(&bus, latchPin, bus._clockPin, bus._dataPin, displayType, sectionSizes, MULTIPLEXED_DRIVE, swappedShiftRegisters, indexes, segments);
+}
+
+void ShiftDisplay2::construct(ShiftBus *bus, int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, bool swappedShiftRegisters, const int indexes[], const int segments[]) {
 
 	// initialize pins
-	_latchPin = latchPin;
+	_bus = bus;
+	_latchPins[0] = latchPin;
+	_latchCount = 1;
 	_clockPin = clockPin;
 	_dataPin = dataPin;
-	pinMode(_latchPin, OUTPUT);
+	pinMode(latchPin, OUTPUT);
 	pinMode(_clockPin, OUTPUT);
 	pinMode(_dataPin, OUTPUT);
 
@@ -61,6 +93,15 @@ void ShiftDisplay2::construct(int latchPin, int clockPin, int dataPin, DisplayTy
 	_isCathode = displayType == COMMON_CATHODE;
 	_isMultiplexed = displayDrive == MULTIPLEXED_DRIVE;
 	_isSwapped = swappedShiftRegisters;
+	_blank = _isCathode ? EMPTY : ~EMPTY;
+	_standbyTimeout = 0;
+	_standbyRate = DEFAULT_STANDBY_RATE;
+	_lastScan = 0;
+	_lastFrame = 0;
+	_isCleared = false;
+	_isSkippingBlanks = DEFAULT_SKIP_BLANKS;
+	_scannedDigits = 0;
+	_skippedDigits = 0;
 
 	// check and initialize indexes global
 	for (int pos = 0; pos < MAX_DISPLAY_SIZE; pos++) {
@@ -71,124 +112,227 @@ void ShiftDisplay2::construct(int latchPin, int clockPin, int dataPin, DisplayTy
 		_indexes[pos] = encodedIndex;
 	}
 
+	// check and initialize segments globals
+	for (int i = 0; i < 8; i++) {
+		int segment = segments[i];
+		_segments[i] = segment >= 0 && segment < 8 ? segment : DEFAULT_SEGMENTS[i];
+	}
+	_dotBit = 7 - _segments[7];
+	_isRemapped = false;
+	for (int i = 0; i < 8; i++)
+		if (_segments[i] != DEFAULT_SEGMENTS[i])
+			_isRemapped = true;
+
 	// check and initialize size globals
-	_displaySize = 0;
+	_cache = _displayCache;
+	_displaySize = initSections(sectionSizes, MAX_DISPLAY_SIZE);
+	_canvasSize = _displaySize;
+	_viewport = 0;
+
+	// clear display
+	clear();
+}
+
+// PRIVATE FUNCTIONS ***********************************************************
+
+int ShiftDisplay2::initSections(const int sectionSizes[], int maxSize) {
+
+	// check and initialize size globals
+	int totalSize = 0;
 	_sectionCount = 0;
 	int	sSize; // loop current section size
-	while ((sSize = sectionSizes[_sectionCount]) > 0) {
+	while (_sectionCount < MAX_DISPLAY_SIZE && (sSize = sectionSizes[_sectionCount]) > 0) {
 
 		// check overflow
-		if (_displaySize + sSize > MAX_DISPLAY_SIZE)
+		if (totalSize + sSize > maxSize)
 			break;
 
-		_sectionBegins[_sectionCount] = _displaySize;
+		_sectionBegins[_sectionCount] = totalSize;
 		_sectionSizes[_sectionCount] = sSize;
-		_displaySize += sSize;
+		totalSize += sSize;
 		_sectionCount++;
 	}
 
-	// clear cache and display
+	// sections owned by no counter or time
+	for (int s = 0; s < MAX_DISPLAY_SIZE; s++)
+		_sectionOwners[s] = NULL;
+
+	// clear cache
 	byte empty = _isCathode ? EMPTY : ~EMPTY;
-	memset(_cache, empty, MAX_DISPLAY_SIZE);
-	clear();
+	memset(_cache, empty, maxSize);
+	markChanged();
+	return totalSize;
+}
+
+bool ShiftDisplay2::beginTransfer() {
+	if (_bus != NULL) {
+		if (_bus->_isBusy)
+			return false;
+		_bus->_isBusy = true;
+		_clockPin = _bus->_clockPin;
+		_dataPin = _bus->_dataPin;
+	}
+	for (int i = 0; i < _latchCount; i++)
+		digitalWrite(_latchPins[i], LOW);
+	return true;
 }
 
-// PRIVATE FUNCTIONS ***********************************************************
+void ShiftDisplay2::endTransfer() {
+	for (int i = 0; i < _latchCount; i++)
+		digitalWrite(_latchPins[i], HIGH);
+	if (_bus != NULL)
+		_bus->_isBusy = false;
+}
 
 void ShiftDisplay2::updateMultiplexedDisplay() {
+	bool isShown = false; // any character was sent
+	int c = _viewport; // cache index of current display index
 	for (int i = 0; i < _displaySize; i++) {
-		digitalWrite(_latchPin, LOW);
-
-		if (!_isSwapped) {
-			shiftOut(_dataPin, _clockPin, LSBFIRST, _indexes[i]); // last shift register
-			shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[i]); // first shift register
-		} else {
-			shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[i]); // last shift register
-			shiftOut(_dataPin, _clockPin, LSBFIRST, _indexes[i]); // first shift register
+		if (_isSkippingBlanks && _cache[c] == _blank) { // nothing to light
+			_skippedDigits++;
+		} else if (beginTransfer()) { // else skip index, bus in use by other display
+
+			if (!_isSwapped) {
+				shiftOut(_dataPin, _clockPin, LSBFIRST, _indexes[i]); // last shift register
+				shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[c]); // first shift register
+			} else {
+				shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[c]); // last shift register
+				shiftOut(_dataPin, _clockPin, LSBFIRST, _indexes[i]); // first shift register
+			}
+
+			endTransfer();
+			_scannedDigits++;
+			_isCleared = false;
+			isShown = true;
+			delay(POV);
 		}
 
-		digitalWrite(_latchPin, HIGH);
-
-		delay(POV);
+		if (++c == _canvasSize) // wrap around canvas
+			c = 0;
 	}
+	_lastFrame = millis();
+
+	// turn off last character, of a previous value or left lit while other displays on bus scan, once
+	if ((!isShown || _bus != NULL) && !_isCleared)
+		clearMultiplexedDisplay();
 }
 
 void ShiftDisplay2::updateStaticDisplay() {
-	digitalWrite(_latchPin, LOW);
-	for (int i = _displaySize - 1; i >= 0 ; i--)
-		shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[i]);
-	digitalWrite(_latchPin, HIGH);
+	if (!beginTransfer())
+		return;
+	for (int i = _displaySize - 1; i >= 0 ; i--) {
+		int c = _viewport + i; // cache index of display index
+		if (c >= _canvasSize) // wrap around canvas
+			c -= _canvasSize;
+		shiftOut(_dataPin, _clockPin, LSBFIRST, _cache[c]);
+	}
+	endTransfer();
+	_scannedDigits += _displaySize;
+	_isDirty = false;
 }
 
-void ShiftDisplay2::clearMultiplexedDisplay() {
-	digitalWrite(_latchPin, LOW);
+bool ShiftDisplay2::clearMultiplexedDisplay() {
+	if (!beginTransfer())
+		return false;
 	shiftOut(_dataPin, _clockPin, MSBFIRST, EMPTY); // 0 at both ends of led
 	shiftOut(_dataPin, _clockPin, MSBFIRST, EMPTY);
-	digitalWrite(_latchPin, HIGH);
+	endTransfer();
+	_isCleared = true;
+	return true;
 }
 
-void ShiftDisplay2::clearStaticDisplay() {
-	digitalWrite(_latchPin, LOW);
+bool ShiftDisplay2::clearStaticDisplay() {
+	if (!beginTransfer())
+		return false;
 	byte empty = _isCathode ? EMPTY : ~EMPTY;
 	for (int i = 0; i < _displaySize; i++)
 		shiftOut(_dataPin, _clockPin, MSBFIRST, empty);
-	digitalWrite(_latchPin, HIGH);
+	endTransfer();
+	_isDirty = true; // cache no longer on display
+	return true;
+}
+
+void ShiftDisplay2::skipUpdate() {
+	if (!_isMultiplexed) { // SD: whole display not sent again
+		_skippedDigits += _displaySize;
+		return;
+	}
+
+	// MD: iterations that would have been shown since last one, not per call
+	unsigned long frameTime = (unsigned long)POV * _displaySize;
+	if (frameTime == 0)
+		return;
+	unsigned long frames = (millis() - _lastFrame) / frameTime;
+	_skippedDigits += frames * _displaySize;
+	_lastFrame += frames * frameTime;
+}
+
+byte ShiftDisplay2::remapSegments(byte code) {
+	byte remapped = EMPTY;
+	for (int i = 0; i < 8; i++)
+		if (bitRead(code, 7 - i)) // abcdefgp is output 0 to 7 when shifted LSBFIRST
+			bitSet(remapped, 7 - _segments[i]);
+	return remapped;
+}
+
+void ShiftDisplay2::markChanged() {
+	_isDirty = true;
+	_lastChange = millis();
+	_isStandbyCleared = false;
 }
 
 void ShiftDisplay2::modifyCache(int index, byte code) {
 	_cache[index] = _isCathode ? code : ~code;
+	markChanged();
 }
 
 void ShiftDisplay2::modifyCache(int beginIndex, int size, const byte codes[]) {
 	for (int i = 0; i < size; i++)
 		_cache[i+beginIndex] = _isCathode ? codes[i] : ~codes[i];
+	markChanged();
+
+	// counters and times of overwritten sections must be fully rendered again
+	for (int s = 0; s < _sectionCount; s++) {
+		if (_sectionBegins[s] >= beginIndex && _sectionBegins[s] < beginIndex + size)
+			_sectionOwners[s] = NULL;
+	}
 }
 
 void ShiftDisplay2::modifyCacheDot(int index, bool dot) {
 	bool bit = _isCathode ? dot : !dot;
-	bitWrite(_cache[index], 0, bit);
+	bitWrite(_cache[index], _dotBit, bit);
+	markChanged();
+}
+
+byte ShiftDisplay2::getCode(char character) {
+	byte code = encodeCharacter(character); // same encoding as encodeText()
+	return _isRemapped ? remapSegments(code) : code;
 }
 
 void ShiftDisplay2::encodeCharacters(int size, const char input[], byte output[], int dotIndex = -1) {
-	for (int i = 0; i < size; i++) {
-		char c = input[i];
-		
-		if (c >= '0' && c <= '9')
-			output[i] = NUMBERS[c - '0'];
-		else if (c >= 'a' && c <= 'z')
-			output[i] = LETTERS[c - 'a'];
-		else if (c >= 'A' && c <= 'Z')
-			output[i] = LETTERS[c - 'A'];
-		else if (c == '-')
-			output[i] = MINUS;
-		else // space or invalid
-			output[i] = EMPTY;
-	}
+	for (int i = 0; i < size; i++)
+		output[i] = getCode(input[i]);
 	
 	if (dotIndex != -1)
-		bitWrite(output[dotIndex], 0, 1);
+		bitWrite(output[dotIndex], _dotBit, 1);
+}
+
+int ShiftDisplay2::getLeftBorder(int inSize, int outSize, Alignment alignment) {
+	if (alignment == ALIGN_LEFT)
+		return 0;
+	if (alignment == ALIGN_RIGHT)
+		return outSize - inSize;
+	return (outSize - inSize) / 2; // ALIGN_CENTER
 }
 
 int ShiftDisplay2::formatCharacters(int inSize, const char input[], int outSize, char output[], Alignment alignment, bool leadingZeros = false, int decimalPlaces = -1) {
 	
-	// index of character virtual borders
-	int left; // lowest index
-	int right; // highest index
+	// index of character virtual borders, calculated according to alignment
+	int left = getLeftBorder(inSize, outSize, alignment); // lowest index
+	int right = left + inSize - 1; // highest index
 
 	int minimum = 0; // minimum display index possible
 	int maximum = outSize - 1; // maximum display index possible
-
-	// calculate borders according to alignment
-	if (alignment == ALIGN_LEFT) {
-		left = minimum;
-		right = inSize - 1;
-	} else if (alignment == ALIGN_RIGHT) {
-		left = outSize - inSize;
-		right = maximum;
-	} else { // ALIGN_CENTER:
-		left = (outSize - inSize) / 2;
-		right = left + inSize - 1;
-	}
 	
 	// fill output array with empty space or characters
 	for (int i = 0; i < left; i++) // before characters
@@ -284,6 +428,31 @@ void ShiftDisplay2::setNumber(double number, int decimalPlaces, bool leadingZero
 		setReal(number, decimalPlaces, leadingZeros, alignment, section);
 }
 
+void ShiftDisplay2::setRadix(unsigned long number, Radix radix, bool leadingZeros, Alignment alignment, int section = 0) {
+	int bits = radix;
+	unsigned long mask = (1 << bits) - 1;
+
+	// count digits by shifting, at least one
+	int valueSize = 1;
+	for (unsigned long rest = number >> bits; rest != 0; rest >>= bits)
+		valueSize++;
+
+	// extract digits by masking, least significant first
+	char originalCharacters[valueSize];
+	for (int i = valueSize - 1; i >= 0; i--) {
+		int digit = number & mask;
+		originalCharacters[i] = digit < 10 ? digit + '0' : digit - 10 + 'a';
+		number >>= bits;
+	}
+
+	int sectionSize = _sectionSizes[section];
+	char formattedCharacters[sectionSize];
+	formatCharacters(valueSize, originalCharacters, sectionSize, formattedCharacters, alignment, leadingZeros);
+	byte encodedCharacters[sectionSize];
+	encodeCharacters(sectionSize, formattedCharacters, encodedCharacters);
+	modifyCache(_sectionBegins[section], sectionSize, encodedCharacters);
+}
+
 void ShiftDisplay2::setText(char value, Alignment alignment, int section = 0) {
 	char originalCharacters[] = {value};
 	int sectionSize = _sectionSizes[section];
@@ -318,6 +487,43 @@ void ShiftDisplay2::setText(const String &value, Alignment alignment, int sectio
 	setText(str, alignment, section); // call char array function
 }
 
+void ShiftDisplay2::setPrinted(int size, const char value[], Alignment alignment, int section = 0) {
+	int sectionSize = _sectionSizes[section];
+	char formattedCharacters[sectionSize];
+	formatCharacters(size, value, sectionSize, formattedCharacters, alignment);
+
+	// split dot flags from characters
+	bool dots[sectionSize];
+	for (int i = 0; i < sectionSize; i++) {
+		dots[i] = formattedCharacters[i] & PRINT_DOT;
+		formattedCharacters[i] &= ~PRINT_DOT;
+	}
+
+	byte encodedCharacters[sectionSize];
+	encodeCharacters(sectionSize, formattedCharacters, encodedCharacters);
+	for (int i = 0; i < sectionSize; i++)
+		if (dots[i])
+			bitWrite(encodedCharacters[i], _dotBit, 1);
+	modifyCache(_sectionBegins[section], sectionSize, encodedCharacters);
+}
+
+void ShiftDisplay2::setEncoded(int size, const byte codes[], bool isFlash, Alignment alignment, int section = 0) {
+	int sectionSize = _sectionSizes[section];
+
+	// same borders as formatCharacters
+	int left = getLeftBorder(size, sectionSize, alignment);
+
+	// copy already encoded characters, empty around them
+	byte encodedCharacters[sectionSize];
+	for (int i = 0, j = -left; i < sectionSize; i++, j++) {
+		byte code = EMPTY;
+		if (j >= 0 && j < size)
+			code = isFlash ? pgm_read_byte(codes + j) : codes[j];
+		encodedCharacters[i] = _isRemapped ? remapSegments(code) : code;
+	}
+	modifyCache(_sectionBegins[section], sectionSize, encodedCharacters);
+}
+
 bool ShiftDisplay2::isValidSection(int section) {
 	return section >= 0 && section < _sectionCount;
 }
@@ -372,6 +578,38 @@ void ShiftDisplay2::set(double number, Alignment alignment) {
 	setNumber(number, DEFAULT_DECIMAL_PLACES_REAL, DEFAULT_LEADING_ZEROS, alignment);
 }
 
+void ShiftDisplay2::set(int number, Radix radix, bool leadingZeros, Alignment alignment) {
+	setRadix((long)number, radix, leadingZeros, alignment);
+}
+
+void ShiftDisplay2::set(int number, Radix radix, Alignment alignment) {
+	setRadix((long)number, radix, DEFAULT_LEADING_ZEROS, alignment);
+}
+
+void ShiftDisplay2::set(unsigned int number, Radix radix, bool leadingZeros, Alignment alignment) {
+	setRadix(number, radix, leadingZeros, alignment);
+}
+
+void ShiftDisplay2::set(unsigned int number, Radix radix, Alignment alignment) {
+	setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment);
+}
+
+void ShiftDisplay2::set(long number, Radix radix, bool leadingZeros, Alignment alignment) {
+	setRadix(number, radix, leadingZeros, alignment);
+}
+
+void ShiftDisplay2::set(long number, Radix radix, Alignment alignment) {
+	setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment);
+}
+
+void ShiftDisplay2::set(unsigned long number, Radix radix, bool leadingZeros, Alignment alignment) {
+	setRadix(number, radix, leadingZeros, alignment);
+}
+
+void ShiftDisplay2::set(unsigned long number, Radix radix, Alignment alignment) {
+	setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment);
+}
+
 void ShiftDisplay2::set(char value, Alignment alignment) {
 	setText(value, alignment);
 }
@@ -452,6 +690,46 @@ void ShiftDisplay2::setAt(int section, double number, Alignment alignment) {
 		setNumber(number, DEFAULT_DECIMAL_PLACES_REAL, DEFAULT_LEADING_ZEROS, alignment, section);
 }
 
+void ShiftDisplay2::setAt(int section, int number, Radix radix, bool leadingZeros, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix((long)number, radix, leadingZeros, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, int number, Radix radix, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix((long)number, radix, DEFAULT_LEADING_ZEROS, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, unsigned int number, Radix radix, bool leadingZeros, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, leadingZeros, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, unsigned int number, Radix radix, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, long number, Radix radix, bool leadingZeros, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, leadingZeros, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, long number, Radix radix, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, unsigned long number, Radix radix, bool leadingZeros, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, leadingZeros, alignment, section);
+}
+
+void ShiftDisplay2::setAt(int section, unsigned long number, Radix radix, Alignment alignment) {
+	if (isValidSection(section))
+		setRadix(number, radix, DEFAULT_LEADING_ZEROS, alignment, section);
+}
+
 void ShiftDisplay2::setAt(int section, char value, Alignment alignment) {
 	if (isValidSection(section))
 		setText(value, alignment, section);
@@ -470,7 +748,10 @@ void ShiftDisplay2::setAt(int section, const String &value, Alignment alignment)
 void ShiftDisplay2::setAt(int section, const byte customs[]) {
 	if (isValidSection(section)) {
 		int sectionSize = _sectionSizes[section];
-		modifyCache(_sectionBegins[section], sectionSize, (byte*) customs);
+		byte remappedCustoms[sectionSize];
+		for (int i = 0; i < sectionSize; i++)
+			remappedCustoms[i] = _isRemapped ? remapSegments(customs[i]) : customs[i];
+		modifyCache(_sectionBegins[section], sectionSize, remappedCustoms);
 	}
 }
 
@@ -486,6 +767,60 @@ void ShiftDisplay2::setAt(int section, const char characters[], const bool dots[
 	}
 }
 
+void ShiftDisplay2::setCanvas(byte canvas[], int canvasSize) {
+	int sectionSizes[] = {canvasSize, 0}; // single section with size of canvas
+	setCanvas(canvas, canvasSize, sectionSizes);
+}
+
+void ShiftDisplay2::setCanvas(byte canvas[], int canvasSize, const int sectionSizes[]) {
+	if (canvasSize < _displaySize) // display always inside canvas
+		return;
+	_cache = canvas;
+	_canvasSize = canvasSize;
+	initSections(sectionSizes, canvasSize);
+	_viewport = 0;
+}
+
+void ShiftDisplay2::setViewport(int offset) {
+	if (_canvasSize == 0)
+		return;
+	offset %= _canvasSize;
+	if (offset < 0)
+		offset += _canvasSize;
+	_viewport = offset;
+	markChanged();
+}
+
+void ShiftDisplay2::moveViewport(int step) {
+	setViewport(_viewport + step);
+}
+
+int ShiftDisplay2::getViewport() {
+	return _viewport;
+}
+
+void ShiftDisplay2::setTime(int hours, int minutes, int seconds, TimeFormat format) {
+	setTimeAt(0, hours, minutes, seconds, format);
+}
+
+void ShiftDisplay2::setDuration(unsigned long milliseconds, TimeFormat format) {
+	setDurationAt(0, milliseconds, format);
+}
+
+void ShiftDisplay2::setTimeAt(int section, int hours, int minutes, int seconds, TimeFormat format) {
+	if (isValidSection(section)) {
+		SectionTime(*this, section, format).setTime(hours, minutes, seconds);
+		_sectionOwners[section] = NULL; // shown once, no time object remains to step it
+	}
+}
+
+void ShiftDisplay2::setDurationAt(int section, unsigned long milliseconds, TimeFormat format) {
+	if (isValidSection(section)) {
+		SectionTime(*this, section, format).setDuration(milliseconds);
+		_sectionOwners[section] = NULL; // shown once, no time object remains to step it
+	}
+}
+
 void ShiftDisplay2::changeDot(int index, bool dot) {
 	changeDotAt(0, index, dot);
 }
@@ -507,16 +842,81 @@ void ShiftDisplay2::changeCharacterAt(int section, int relativeIndex, byte custo
 	if (isValidSection(section)) {
 		if (relativeIndex >= 0 && relativeIndex < _sectionSizes[section]) { // valid index in display
 			int index = _sectionBegins[section] + relativeIndex;
-			modifyCache(index, custom);
+			modifyCache(index, _isRemapped ? remapSegments(custom) : custom);
 		}
 	}
 }
 
+void ShiftDisplay2::addMirror(int latchPin) {
+	if (_latchCount < MAX_LATCH_PINS) {
+		pinMode(latchPin, OUTPUT);
+		_latchPins[_latchCount++] = latchPin;
+	}
+}
+
+void ShiftDisplay2::removeMirrors() {
+	_latchCount = 1;
+}
+
 void ShiftDisplay2::update() {
+	if (isStandby()) {
+
+		// display off, cleared once, retried while bus is busy
+		if (_standbyRate <= 0) {
+			if (!_isStandbyCleared)
+				_isStandbyCleared = _isMultiplexed ? clearMultiplexedDisplay() : clearStaticDisplay();
+			skipUpdate();
+			return;
+		}
+
+		// MD: single iteration at standby rate, then off until next one
+		unsigned long now = millis();
+		if (now - _lastScan < 1000UL / _standbyRate) {
+			skipUpdate();
+			return;
+		}
+		_lastScan = now;
+		if (_isMultiplexed) {
+			updateMultiplexedDisplay();
+			if (!_isCleared)
+				clearMultiplexedDisplay();
+			return;
+		}
+	}
+
 	if (_isMultiplexed)
 		updateMultiplexedDisplay();
-	else
+	else if (_isDirty)
 		updateStaticDisplay();
+	else // SD: already showing cache
+		skipUpdate();
+}
+
+void ShiftDisplay2::setStandby(unsigned long timeout, int rate) {
+	_standbyTimeout = timeout;
+	_standbyRate = rate;
+	markChanged();
+}
+
+bool ShiftDisplay2::isStandby() {
+	return _standbyTimeout > 0 && millis() - _lastChange >= _standbyTimeout;
+}
+
+void ShiftDisplay2::setSkipBlanks(bool skip) {
+	_isSkippingBlanks = skip;
+}
+
+unsigned long ShiftDisplay2::getScannedDigits() {
+	return _scannedDigits;
+}
+
+unsigned long ShiftDisplay2::getSkippedDigits() {
+	return _skippedDigits;
+}
+
+void ShiftDisplay2::resetScanCounters() {
+	_scannedDigits = 0;
+	_skippedDigits = 0;
 }
 
 void ShiftDisplay2::clear() {
@@ -591,3 +991,402 @@ void ShiftDisplay2::setDot(int index, bool dot) { changeDot(index, dot); }
 void ShiftDisplay2::setDotAt(int section, int relativeIndex, bool dot) { changeDotAt(section, relativeIndex, dot); }
 void ShiftDisplay2::setCustom(int index, byte custom) { changeCharacter(index, custom); }
 void ShiftDisplay2::setCustomAt(int section, int relativeIndex, byte custom) { changeCharacterAt(section, relativeIndex, custom); }
+
+// SHIFT BUS *******************************************************************
+
+bool ShiftBus::isBusy() {
+	return _isBusy;
+}
+
+// SECTION PRINTER *************************************************************
+
+SectionPrinter::SectionPrinter(ShiftDisplay2 &display, int section, Alignment alignment) : _display(display) {
+	_section = section;
+	_alignment = alignment;
+	_size = 0;
+}
+
+size_t SectionPrinter::write(uint8_t character) {
+	if (character == '\n') {
+		flush();
+		return 1;
+	}
+	if (character == '\r')
+		return 1;
+
+	// dot joins previous character, if it has none yet
+	if (character == '.') {
+		if (_size > 0 && !(_characters[_size-1] & PRINT_DOT)) {
+			_characters[_size-1] |= PRINT_DOT;
+			return 1;
+		}
+		character = ' ' | PRINT_DOT;
+	} else if (character & PRINT_DOT) // not ascii
+		character = ' ';
+
+	// when full, right alignment keeps last characters, others keep first
+	if (_size == MAX_PRINT_SIZE) {
+		if (_alignment != ALIGN_RIGHT)
+			return 1;
+		memmove(_characters, _characters + 1, MAX_PRINT_SIZE - 1);
+		_size--;
+	}
+
+	_characters[_size++] = character;
+	return 1;
+}
+
+void SectionPrinter::flush() {
+	if (_display.isValidSection(_section))
+		_display.setPrinted(_size, _characters, _alignment, _section);
+	_size = 0;
+}
+
+// SECTION COUNTER *************************************************************
+
+SectionCounter::SectionCounter(ShiftDisplay2 &display, int section, bool leadingZeros, Alignment alignment) : _display(display) {
+	_section = section;
+	_leadingZeros = leadingZeros;
+	_alignment = alignment;
+	memset(_digits, 0, MAX_COUNTER_SIZE / 2);
+	_length = 1;
+	_isNegative = false;
+}
+
+SectionCounter::SectionCounter(ShiftDisplay2 &display, int section, Alignment alignment) : SectionCounter(display, section, DEFAULT_LEADING_ZEROS, alignment) {}
+
+int SectionCounter::getSize() {
+	int size = _display._sectionSizes[_section];
+	return size < MAX_COUNTER_SIZE ? size : MAX_COUNTER_SIZE;
+}
+
+void SectionCounter::load(byte digits[]) {
+	for (int i = 0; i < getSize(); i++)
+		digits[i] = (_digits[i / 2] >> (i % 2 * 4)) & 0x0F;
+}
+
+void SectionCounter::addAmount(bool negative, unsigned long amount) {
+	const int amountWidth = sizeof(unsigned long) * 3; // enough decimal digits for any amount
+	int size = getSize();
+	int width = size > amountWidth ? size : amountWidth; // whole counter and any amount
+	byte a[width]; // amount digits, least significant first
+	byte m[width]; // counter magnitude digits, least significant first
+
+	// split amount and load counter
+	memset(a, 0, width);
+	int amountLength = 0;
+	while (amount > 0) {
+		a[amountLength++] = amount % 10;
+		amount /= 10;
+	}
+	memset(m, 0, width);
+	load(m);
+	bool isZero = _length == 1 && m[0] == 0;
+	bool resultNegative;
+
+	if (isZero || negative == _isNegative) {
+
+		// same sign: add magnitudes, rippling carry
+		int carry = 0;
+		for (int i = 0; i < width && (i < amountLength || carry); i++) {
+			int digit = m[i] + a[i] + carry;
+			carry = digit > 9;
+			m[i] = carry ? digit - 10 : digit;
+		}
+		resultNegative = negative;
+
+	} else {
+
+		// opposite sign: subtract smaller magnitude from bigger, rippling borrow
+		int i = width - 1;
+		while (i > 0 && m[i] == a[i])
+			i--;
+		bool counterBigger = m[i] >= a[i];
+		const byte *big = counterBigger ? m : a;
+		const byte *small = counterBigger ? a : m;
+		int length = counterBigger ? width : amountLength;
+		int borrow = 0;
+		for (i = 0; i < length; i++) {
+			int digit = big[i] - small[i] - borrow;
+			borrow = digit < 0;
+			m[i] = borrow ? digit + 10 : digit;
+		}
+		resultNegative = counterBigger ? _isNegative : negative;
+	}
+
+	// store back, wrapping around counter size like an odometer
+	memset(_digits, 0, MAX_COUNTER_SIZE / 2);
+	for (int i = 0; i < size; i++)
+		_digits[i / 2] |= m[i] << (i % 2 * 4);
+	int length = size;
+	while (length > 1 && m[length-1] == 0)
+		length--;
+	_length = length;
+	_isNegative = resultNegative && !(length == 1 && m[0] == 0);
+}
+
+void SectionCounter::render() {
+	byte digits[MAX_COUNTER_SIZE];
+	load(digits);
+
+	// write digits as characters, most significant first
+	int valueSize = _isNegative ? _length + 1 : _length;
+	char originalCharacters[valueSize];
+	for (int i = 0, j = valueSize - 1; i < _length; i++, j--)
+		originalCharacters[j] = digits[i] + '0';
+	if (_isNegative)
+		originalCharacters[0] = '-';
+
+	int sectionSize = _display._sectionSizes[_section];
+	char formattedCharacters[sectionSize];
+	_display.formatCharacters(valueSize, originalCharacters, sectionSize, formattedCharacters, _alignment, _leadingZeros);
+	byte encodedCharacters[sectionSize];
+	_display.encodeCharacters(sectionSize, formattedCharacters, encodedCharacters);
+	_display.modifyCache(_display._sectionBegins[_section], sectionSize, encodedCharacters);
+	_display._sectionOwners[_section] = this;
+}
+
+void SectionCounter::render(const byte oldDigits[], bool oldNegative, int oldLength) {
+
+	// overwritten by other value or borders changed, every character can move
+	if (_display._sectionOwners[_section] != this || _isNegative != oldNegative || _length != oldLength) {
+		render();
+		return;
+	}
+
+	// same borders as formatCharacters
+	int begin = _display._sectionBegins[_section];
+	int sectionSize = _display._sectionSizes[_section];
+	int valueSize = _isNegative ? _length + 1 : _length;
+	int right = _display.getLeftBorder(valueSize, sectionSize, _alignment) + valueSize - 1;
+
+	// rewrite changed digits only
+	byte digits[MAX_COUNTER_SIZE];
+	load(digits);
+	for (int i = 0; i < _length; i++) {
+		byte digit = digits[i];
+		int index = right - i;
+		if (digit != oldDigits[i] && index >= 0 && index < sectionSize)
+			_display.modifyCache(begin + index, _display.getCode(digit + '0'));
+	}
+}
+
+void SectionCounter::set(long value) {
+	if (_display.isValidSection(_section)) {
+
+		// reset to zero then add value
+		memset(_digits, 0, MAX_COUNTER_SIZE / 2);
+		_length = 1;
+		_isNegative = false;
+		unsigned long amount = value < 0 ? -(unsigned long)value : value;
+		addAmount(value < 0, amount);
+
+		render();
+	}
+}
+
+void SectionCounter::increment() {
+	add(1);
+}
+
+void SectionCounter::decrement() {
+	add(-1);
+}
+
+void SectionCounter::add(long amount) {
+	if (_display.isValidSection(_section)) {
+		byte oldDigits[MAX_COUNTER_SIZE];
+		load(oldDigits);
+		bool oldNegative = _isNegative;
+		int oldLength = _length;
+		unsigned long magnitude = amount < 0 ? -(unsigned long)amount : amount;
+		addAmount(amount < 0, magnitude);
+		render(oldDigits, oldNegative, oldLength);
+	}
+}
+
+// SECTION TIME ****************************************************************
+
+SectionTime::SectionTime(ShiftDisplay2 &display, int section, TimeFormat format) : _display(display) {
+	_section = section;
+	_format = format;
+	memset(_fields, 0, 3);
+}
+
+void SectionTime::setValue(long hours, long minutes, long seconds, long tenths) {
+	long values[3];
+	if (_format == TIME_HH_MM) {
+		values[0] = minutes;
+		values[1] = hours;
+	} else if (_format == TIME_MM_SS) {
+		values[0] = seconds;
+		values[1] = minutes;
+	} else if (_format == TIME_HH_MM_SS) {
+		values[0] = seconds;
+		values[1] = minutes;
+		values[2] = hours;
+	} else { // TIME_SS_T
+		values[0] = tenths;
+		values[1] = seconds;
+	}
+
+	// convert to BCD, wrapping around field limit
+	for (int i = 0; i < TIME_FIELD_COUNTS[_format]; i++) {
+		byte limit = TIME_LIMITS[_format][i];
+		long value = values[i] < 0 ? 0 : values[i] % ((limit >> 4) * 10 + (limit & 0x0F));
+		byte tens = 0;
+		while (value >= 10) {
+			value -= 10;
+			tens++;
+		}
+		_fields[i] = (tens << 4) | value;
+	}
+
+	render();
+}
+
+void SectionTime::step(bool forward) {
+
+	// ripple carry or borrow through fields, adjusting BCD
+	for (int i = 0; i < TIME_FIELD_COUNTS[_format]; i++) {
+		byte limit = TIME_LIMITS[_format][i];
+		byte field = _fields[i];
+		if (forward) {
+			field++;
+			if ((field & 0x0F) == 10)
+				field += 6;
+			if (field >= limit) {
+				_fields[i] = 0;
+				continue;
+			}
+		} else {
+			if (field == 0) {
+				field = limit - 1;
+				if ((field & 0x0F) == 0x0F)
+					field -= 6;
+				_fields[i] = field;
+				continue;
+			}
+			field--;
+			if ((field & 0x0F) == 0x0F)
+				field -= 6;
+		}
+		_fields[i] = field;
+		break;
+	}
+}
+
+int SectionTime::getDigits(const byte fields[], byte digits[], bool dots[]) {
+	int size = 0;
+	for (int i = 0; i < TIME_FIELD_COUNTS[_format]; i++) {
+		digits[size] = fields[i] & 0x0F;
+		dots[size++] = i > 0; // separator after units of upper fields
+		if (TIME_LIMITS[_format][i] > 0x10) { // two digits field
+			digits[size] = fields[i] >> 4;
+			dots[size++] = false;
+		}
+	}
+	return size;
+}
+
+void SectionTime::render() {
+	byte digits[6];
+	bool dots[6];
+	int valueSize = getDigits(_fields, digits, dots);
+
+	// write digits as characters, most significant first
+	char originalCharacters[valueSize];
+	for (int i = 0, j = valueSize - 1; i < valueSize; i++, j--)
+		originalCharacters[j] = digits[i] + '0';
+
+	int sectionSize = _display._sectionSizes[_section];
+	char formattedCharacters[sectionSize];
+	_display.formatCharacters(valueSize, originalCharacters, sectionSize, formattedCharacters, ALIGN_RIGHT);
+	byte encodedCharacters[sectionSize];
+	_display.encodeCharacters(sectionSize, formattedCharacters, encodedCharacters);
+	for (int i = 0, index = sectionSize - 1; i < valueSize && index >= 0; i++, index--)
+		if (dots[i])
+			bitWrite(encodedCharacters[index], _display._dotBit, 1);
+	_display.modifyCache(_display._sectionBegins[_section], sectionSize, encodedCharacters);
+	_display._sectionOwners[_section] = this;
+}
+
+void SectionTime::render(const byte oldFields[]) {
+
+	// overwritten by other value, show again entirely
+	if (_display._sectionOwners[_section] != this) {
+		render();
+		return;
+	}
+
+	byte digits[6];
+	byte oldDigits[6];
+	bool dots[6];
+	int valueSize = getDigits(_fields, digits, dots);
+	getDigits(oldFields, oldDigits, dots);
+
+	// rewrite changed digits only, right aligned
+	int begin = _display._sectionBegins[_section];
+	for (int i = 0, index = _display._sectionSizes[_section] - 1; i < valueSize && index >= 0; i++, index--) {
+		if (digits[i] != oldDigits[i]) {
+			byte code = _display.getCode(digits[i] + '0');
+			if (dots[i])
+				bitWrite(code, _display._dotBit, 1);
+			_display.modifyCache(begin + index, code);
+		}
+	}
+}
+
+void SectionTime::setTime(int hours, int minutes, int seconds) {
+	if (_display.isValidSection(_section))
+		setValue(hours, minutes, seconds, 0);
+}
+
+void SectionTime::setDuration(unsigned long milliseconds) {
+	if (_display.isValidSection(_section)) {
+		long tenths = milliseconds % 1000 / 100;
+		long seconds = milliseconds / 1000;
+		long minutes = seconds / 60;
+
+		// most significant field of format takes the whole remaining time, saturating instead of wrapping
+		if (_format == TIME_SS_T) {
+			if (seconds > 99) { // longest is 99.9
+				seconds = 99;
+				tenths = 9;
+			}
+			setValue(0, 0, seconds, tenths);
+		} else if (_format == TIME_MM_SS) {
+			if (minutes > 99) { // longest is 99.59
+				minutes = 99;
+				seconds = 59;
+			}
+			setValue(0, minutes, seconds % 60, tenths);
+		} else {
+			long hours = minutes / 60;
+			if (hours > 23) { // longest is 23.59 or 23.59.59
+				hours = 23;
+				minutes = 59;
+				seconds = 59;
+			}
+			setValue(hours, minutes % 60, seconds % 60, tenths);
+		}
+	}
+}
+
+void SectionTime::increment() {
+	if (_display.isValidSection(_section)) {
+		byte oldFields[3];
+		memcpy(oldFields, _fields, 3);
+		step(true);
+		render(oldFields);
+	}
+}
+
+void SectionTime::decrement() {
+	if (_display.isValidSection(_section)) {
+		byte oldFields[3];
+		memcpy(oldFields, _fields, 3);
+		step(false);
+		render(oldFields);
+	}
+}
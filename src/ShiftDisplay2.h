@@ -8,6 +8,8 @@ https://ameer.io/ShiftDisplay2/
 #ifndef ShiftDisplay2_h
 #define ShiftDisplay2_h
 #include "Arduino.h"
+#include "Print.h"
+#include "CharacterEncoding.h"
 
 enum DisplayType {
 	COMMON_ANODE,
@@ -22,6 +24,17 @@ enum Alignment {
 	ALIGN_RIGHT = 'R',
 	ALIGN_CENTER = 'C'
 };
+enum Radix { // bits per digit
+	RADIX_BIN = 1,
+	RADIX_OCT = 3,
+	RADIX_HEX = 4
+};
+enum TimeFormat {
+	TIME_HH_MM,
+	TIME_MM_SS,
+	TIME_HH_MM_SS,
+	TIME_SS_T
+};
 
 const int DEFAULT_LATCH_PIN = 6;
 const int DEFAULT_CLOCK_PIN = 7;
@@ -33,43 +46,103 @@ const int DEFAULT_DECIMAL_PLACES_INTEGER = 0;
 const bool DEFAULT_LEADING_ZEROS = false;
 const bool DEFAULT_CHANGE_DOT = true;
 const DisplayDrive DEFAULT_DRIVE = MULTIPLEXED_DRIVE;
+const TimeFormat DEFAULT_TIME_FORMAT = TIME_HH_MM;
+const TimeFormat DEFAULT_DURATION_FORMAT = TIME_MM_SS;
 const int DEFAULT_INDEXES[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+const int DEFAULT_SEGMENTS[] = { 0, 1, 2, 3, 4, 5, 6, 7 };
 
 const int MAX_DISPLAY_SIZE = 8;
+const int MAX_LATCH_PINS = 4; // display latch pin plus mirrors
+const int MAX_COUNTER_SIZE = MAX_DISPLAY_SIZE; // decimal digits kept by a SectionCounter
+const int MAX_PRINT_SIZE = 2 * MAX_DISPLAY_SIZE; // characters kept by SectionPrinter until flush
 const int POV = 1; // milliseconds showing each character when multiplexing
+const int DEFAULT_STANDBY_RATE = 0; // display off in standby
+const bool DEFAULT_SKIP_BLANKS = false; // MD: constant iteration length and brightness
+
+class ShiftBus {
+
+	// clock and data pins shared by displays with separate latch pins
+
+	friend class ShiftDisplay2;
+
+	private:
+
+		int _clockPin;
+		int _dataPin;
+		volatile bool _isBusy; // a display is transferring
+
+	public:
+
+		constexpr ShiftBus(int clockPin = DEFAULT_CLOCK_PIN, int dataPin = DEFAULT_DATA_PIN) : _clockPin(clockPin), _dataPin(dataPin), _isBusy(false) {} // constant, so ready before any display is constructed
+
+		bool isBusy();
+};
 
 class ShiftDisplay2 {
 
 	// MD: for multiplexed drive displays
 	// SD: for static drive displays
 
+	friend class SectionPrinter;
+	friend class SectionCounter;
+	friend class SectionTime;
+
 	private:
 
-		int _latchPin;
-		int _clockPin;
-		int _dataPin;
+		ShiftBus *_bus; // shared bus to arbitrate, NULL if pins are not shared
+		int _latchPins[MAX_LATCH_PINS]; // display latch pin, then mirrors
+		int _latchCount; // quantity of latch pins
+		int _clockPin; // read from bus on each transfer if shared
+		int _dataPin; // read from bus on each transfer if shared
 		bool _isCathode;
 		bool _isMultiplexed;
 		bool _isSwapped; // shift registers are swapped (first indexes then segments)
 		int _displaySize; // length of whole display
+		int _canvasSize; // length of cache, display size or bigger when canvas is set
+		int _viewport; // cache index shown on first display index
+		byte _blank; // cache value of an empty character
+		bool _isDirty; // SD: cache changed since last sent to display
+		unsigned long _lastChange; // millis of last cache change
+		unsigned long _lastScan; // millis of last scan in standby
+		unsigned long _lastFrame; // MD: millis of last iteration, scanned or counted as skipped
+		unsigned long _standbyTimeout; // milliseconds without changes before standby, 0 if never
+		int _standbyRate; // scans per second in standby, 0 for display off
+		bool _isStandbyCleared; // display already cleared in standby
+		bool _isCleared; // MD: nothing lit since last clear
+		bool _isSkippingBlanks; // MD: blank characters are not shown, shortening iteration
+		unsigned long _scannedDigits; // digits sent to display
+		unsigned long _skippedDigits; // MD: digits not shown in the time of skipped iterations or being blank; SD: digits not sent again
 		int _sectionCount; // quantity of display sections
 		int _sectionSizes[MAX_DISPLAY_SIZE]; // length of each section
-		int _sectionBegins[MAX_DISPLAY_SIZE]; // index where each section begins on whole display
+		int _sectionBegins[MAX_DISPLAY_SIZE]; // index where each section begins on cache
 		byte _indexes[MAX_DISPLAY_SIZE]; // each display index in order (encoded)
-		byte _cache[MAX_DISPLAY_SIZE]; // value to show on display (encoded in abcdefgp format)
+		byte _segments[8]; // shift register output of each segment in abcdefgp order
+		byte _dotBit; // bit of the dot segment in cache
+		bool _isRemapped; // segments wiring is not default
+		byte _displayCache[MAX_DISPLAY_SIZE]; // cache used while no canvas is set
+		byte *_cache; // value to show on display, seen through viewport (encoded in abcdefgp format)
+		const void *_sectionOwners[MAX_DISPLAY_SIZE]; // object whose value each section cache holds (not overwritten since its last render), NULL if none
 
-		void construct(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, bool swappedShiftRegisters, const int indexes[]); // common instructions to be called by constructors
+		void construct(ShiftBus *bus, int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive, bool swappedShiftRegisters, const int indexes[], const int segments[]); // common instructions to be called by constructors
+		int initSections(const int sectionSizes[], int maxSize); // check and initialize sections on cache, clearing it, returns total size
 
+		bool beginTransfer(); // claim bus and lower latches, returns false if bus is busy
+		void endTransfer(); // raise latches, showing shifted data on display and mirrors, and release bus
 		void updateMultiplexedDisplay(); // MD: iterate stored value on each display index, achieving persistence of vision
 		void updateStaticDisplay(); // SD: send stored value to whole display
-		void clearMultiplexedDisplay(); // MD: clear both shift registers
-		void clearStaticDisplay(); // SD: clear all shift registers
+		bool clearMultiplexedDisplay(); // MD: clear both shift registers, false if bus is busy
+		bool clearStaticDisplay(); // SD: clear all shift registers, false if bus is busy
+		void skipUpdate(); // count digits skipped by an update, MD: of iterations that fit in the time since last one; SD: whole display
 
+		byte remapSegments(byte code); // convert a character in abcdefgp format to segments wiring
+		void markChanged(); // flag cache as changed, leaving standby
 		void modifyCache(int index, byte code); // replace a position in cache
 		void modifyCache(int beginIndex, int size, const byte codes[]); // replace a interval in cache
 		void modifyCacheDot(int index, bool dot); // change dot in a cache position
 
+		byte getCode(char character); // encode a char in abcdefgp format, remapped to segments wiring
 		void encodeCharacters(int size, const char input[], byte output[], int dotIndex); // encode array of chars to array of bytes in abcdefgp format
+		int getLeftBorder(int inSize, int outSize, Alignment alignment); // lowest index of characters aligned in output, may be negative
 		int formatCharacters(int inSize, const char input[], int outSize, char output[], Alignment alignment, bool leadingZeros, int decimalPlaces); // arrange array of chars for displaying in specified alignment, returns dot index on display or -1 if none
 		void getCharacters(long input, int size, char output[]); // convert an integer number to an array of chars
 		int countCharacters(long number); // calculate the length of an array of chars for an integer number
@@ -79,23 +152,31 @@ class ShiftDisplay2 {
 		void setReal(double value, int decimalPlaces, bool leadingZeros, Alignment alignment, int section);
 		void setNumber(long number, int decimalPlaces, bool leadingZeros, Alignment alignment, int section);
 		void setNumber(double number, int decimalPlaces, bool leadingZeros, Alignment alignment, int section);
+		void setRadix(unsigned long number, Radix radix, bool leadingZeros, Alignment alignment, int section);
 		void setText(char value, Alignment alignment, int section);
 		void setText(const char value[], Alignment alignment, int section);
 		void setText(const String &value, Alignment alignment, int section);
+		void setEncoded(int size, const byte codes[], bool isFlash, Alignment alignment, int section); // codes in RAM or stored in PROGMEM
+		void setPrinted(int size, const char value[], Alignment alignment, int section); // chars flagged with PRINT_DOT show a dot
+
 
 		bool isValidSection(int section);
 
 	public:
 
 		// constructors
-		ShiftDisplay2(DisplayType displayType, int displaySize, DisplayDrive displayDrive = DEFAULT_DRIVE); // default connections, whole display, default pins
-		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive = DEFAULT_DRIVE); // default connections, whole display, custom pins
-		ShiftDisplay2(DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive = DEFAULT_DRIVE); // default connections, sectioned display, default pins
-		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive = DEFAULT_DRIVE); // default connections, sectioned display, custom pins
-		ShiftDisplay2(DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES); // custom connections, whole display, default pins
-		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES); // custom connections, whole display, custom pins
-		ShiftDisplay2(DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES); // custom connections, sectioned display, default pins
-		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES); // custom connections, sectioned display, custom pins
+		ShiftDisplay2(DisplayType displayType, int displaySize, DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, whole display, default pins
+		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, whole display, custom pins
+		ShiftDisplay2(DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, sectioned display, default pins
+		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, sectioned display, custom pins
+		ShiftDisplay2(DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, whole display, default pins
+		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, whole display, custom pins
+		ShiftDisplay2(DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, sectioned display, default pins
+		ShiftDisplay2(int latchPin, int clockPin, int dataPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, sectioned display, custom pins
+		ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, int displaySize, DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, whole display, shared bus
+		ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, const int sectionSizes[], DisplayDrive displayDrive = DEFAULT_DRIVE, const int segments[] = DEFAULT_SEGMENTS); // default connections, sectioned display, shared bus
+		ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, int displaySize, bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, whole display, shared bus
+		ShiftDisplay2(ShiftBus &bus, int latchPin, DisplayType displayType, const int sectionSizes[], bool swappedShiftRegisters, const int indexes[] = DEFAULT_INDEXES, const int segments[] = DEFAULT_SEGMENTS); // custom connections, sectioned display, shared bus
 
 		// cache value
 		void set(int number, int decimalPlaces = DEFAULT_DECIMAL_PLACES_INTEGER, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
@@ -110,11 +191,21 @@ class ShiftDisplay2 {
 		void set(double number, bool leadingZeros, Alignment alignment = DEFAULT_ALIGN_NUMBER); // override decimalPlaces obligation
 		void set(double number, int decimalPlaces, Alignment alignment); // override leadingZeros obligation
 		void set(double number, Alignment alignment); // override decimalPlaces and leadingZeros obligation
+		void set(int number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER); // binary, octal or hexadecimal, as two's complement
+		void set(int number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void set(unsigned int number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void set(unsigned int number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void set(long number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void set(long number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void set(unsigned long number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void set(unsigned long number, Radix radix, Alignment alignment); // override leadingZeros obligation
 		void set(char value, Alignment alignment = DEFAULT_ALIGN_TEXT);
 		void set(const char value[], Alignment alignment = DEFAULT_ALIGN_TEXT); // c string
 		void set(const String &value, Alignment alignment = DEFAULT_ALIGN_TEXT); // Arduino string object
-		void set(const byte customs[]); // custom characters (encoded in abcdefgp format), array length must match display size
-		void set(const char characters[], const bool dots[]); // arrays length must match display size
+		template<int N> void set(const EncodedText<N> &text, Alignment alignment = DEFAULT_ALIGN_TEXT) { setEncoded(N, text.codes, false, alignment, 0); } // encodeText() in RAM
+		template<int N> void set(const FlashEncodedText<N> &text, Alignment alignment = DEFAULT_ALIGN_TEXT) { setEncoded(N, text.text->codes, true, alignment, 0); } // encodeText() stored in PROGMEM, wrapped by inFlash()
+		void set(const byte customs[]); // custom characters (encoded in abcdefgp format) on section 0, array length must match its size
+		void set(const char characters[], const bool dots[]); // on section 0, arrays length must match its size
 		void setAt(int section, int number, int decimalPlaces = DEFAULT_DECIMAL_PLACES_INTEGER, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
 		void setAt(int section, int number, bool leadingZeros, Alignment alignment = DEFAULT_ALIGN_NUMBER); // override decimalPlaces obligation
 		void setAt(int section, int number, int decimalPlaces, Alignment alignment); // override leadingZeros obligation
@@ -127,12 +218,26 @@ class ShiftDisplay2 {
 		void setAt(int section, double number, bool leadingZeros, Alignment alignment = DEFAULT_ALIGN_NUMBER); // override decimalPlaces obligation
 		void setAt(int section, double number, int decimalPlaces, Alignment alignment); // override leadingZeros obligation
 		void setAt(int section, double number, Alignment alignment); // override decimalPlaces and leadingZeros obligation
+		void setAt(int section, int number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER); // binary, octal or hexadecimal, as two's complement
+		void setAt(int section, int number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void setAt(int section, unsigned int number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void setAt(int section, unsigned int number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void setAt(int section, long number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void setAt(int section, long number, Radix radix, Alignment alignment); // override leadingZeros obligation
+		void setAt(int section, unsigned long number, Radix radix, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		void setAt(int section, unsigned long number, Radix radix, Alignment alignment); // override leadingZeros obligation
 		void setAt(int section, char value, Alignment alignment = DEFAULT_ALIGN_TEXT);
 		void setAt(int section, const char value[], Alignment alignment = DEFAULT_ALIGN_TEXT); // c string
 		void setAt(int section, const String &value, Alignment alignment = DEFAULT_ALIGN_TEXT); // Arduino string object
+		template<int N> void setAt(int section, const EncodedText<N> &text, Alignment alignment = DEFAULT_ALIGN_TEXT) { if (isValidSection(section)) setEncoded(N, text.codes, false, alignment, section); } // encodeText() in RAM
+		template<int N> void setAt(int section, const FlashEncodedText<N> &text, Alignment alignment = DEFAULT_ALIGN_TEXT) { if (isValidSection(section)) setEncoded(N, text.text->codes, true, alignment, section); } // encodeText() stored in PROGMEM, wrapped by inFlash()
 		void setAt(int section, const byte customs[]); // custom characters (encoded in abcdefgp format), array length must match defined section size
 		void setAt(int section, const char characters[], const bool dots[]); // arrays length must match defined section size
 		void scroll(String &value, int speed = 300); // scrolling text
+		void setTime(int hours, int minutes, int seconds, TimeFormat format = DEFAULT_TIME_FORMAT); // clock time, separated by dots
+		void setDuration(unsigned long milliseconds, TimeFormat format = DEFAULT_DURATION_FORMAT); // elapsed time, separated by dots
+		void setTimeAt(int section, int hours, int minutes, int seconds, TimeFormat format = DEFAULT_TIME_FORMAT); // clock time, separated by dots
+		void setDurationAt(int section, unsigned long milliseconds, TimeFormat format = DEFAULT_DURATION_FORMAT); // elapsed time, separated by dots
 		void scroll(const char value[], int speed = 300); // scrolling text
 		void scroll(char value, int speed = 300); // scrolling text
 
@@ -142,8 +247,31 @@ class ShiftDisplay2 {
 		void changeDotAt(int section, int relativeIndex, bool dot = DEFAULT_CHANGE_DOT); // show or hide a dot on character
 		void changeCharacterAt(int section, int relativeIndex, byte custom); // replace with a custom character (encoded in abcdefgp format)
 
+		// define a canvas bigger than the display, seen through a viewport
+		void setCanvas(byte canvas[], int canvasSize); // whole canvas as one section, array must outlive display
+		void setCanvas(byte canvas[], int canvasSize, const int sectionSizes[]); // sectioned canvas, array must outlive display
+		void setViewport(int offset); // canvas index shown on leftmost digit, wraps around canvas
+		void moveViewport(int step = 1); // pan viewport, negative to the left
+		int getViewport();
+
+		// modify time value by one unit of its format, rewriting only the changed digits
+
+		// latch another display with identical connections on the same data, showing the same value with no extra shifting
+		void addMirror(int latchPin);
+		void removeMirrors();
+
 		// show cached value on display
-		void update(); // MD: for a single iteration; SD: while not update/clear/show called
+		void update(); // MD: for a single iteration; SD: while not update/clear/show called, sent only if changed
+
+		// reduce scanning after a time without changes to cached value
+		void setStandby(unsigned long timeout, int rate = DEFAULT_STANDBY_RATE); // timeout 0 disables standby
+		bool isStandby();
+		void setSkipBlanks(bool skip); // MD: do not show blank characters, shorter iteration is brighter
+
+		// scan statistics, on MD each skipped digit is POV milliseconds not spent showing it, on SD a digit not shifted again
+		unsigned long getScannedDigits();
+		unsigned long getSkippedDigits();
+		void resetScanCounters();
 
 		// clear display content
 		void clear();
@@ -181,4 +309,83 @@ class ShiftDisplay2 {
 		void setCustomAt(int section, int relativeIndex, byte custom);
 };
 
+class SectionPrinter : public Print {
+
+	// streams print() output of Print class into a display section, without String
+
+	private:
+
+		ShiftDisplay2 &_display;
+		int _section;
+		Alignment _alignment;
+		int _size; // quantity of characters printed since last flush
+		char _characters[MAX_PRINT_SIZE]; // characters printed since last flush (with dot flag)
+
+	public:
+
+		SectionPrinter(ShiftDisplay2 &display, int section = 0, Alignment alignment = DEFAULT_ALIGN_TEXT);
+
+		using Print::write; // keep write of strings and buffers
+		size_t write(uint8_t character); // store a character; a dot goes to previous character, newline flushes
+		void flush(); // encode stored characters to section cache, clearing previous section value
+};
+
+class SectionCounter {
+
+	// counter shown on a display section, updated digit by digit
+
+	private:
+
+		ShiftDisplay2 &_display;
+		int _section;
+		bool _leadingZeros;
+		Alignment _alignment;
+		byte _digits[MAX_COUNTER_SIZE / 2]; // decimal digits in BCD, least significant first
+		byte _length; // quantity of significant digits
+		bool _isNegative;
+
+		int getSize(); // quantity of digits kept, section size up to MAX_COUNTER_SIZE
+		void load(byte digits[]); // unpack digits, least significant first
+		void addAmount(bool negative, unsigned long amount); // add a signed amount, digit by digit
+		void render(); // encode whole counter to section cache
+		void render(const byte oldDigits[], bool oldNegative, int oldLength); // encode only the digits that changed
+
+	public:
+
+		SectionCounter(ShiftDisplay2 &display, int section = 0, bool leadingZeros = DEFAULT_LEADING_ZEROS, Alignment alignment = DEFAULT_ALIGN_NUMBER);
+		SectionCounter(ShiftDisplay2 &display, int section, Alignment alignment); // override leadingZeros obligation
+
+		void set(long value); // clear section and show value
+		void increment();
+		void decrement();
+		void add(long amount); // negative to subtract
+};
+
+class SectionTime {
+
+	// clock or elapsed time shown on a display section, stepped digit by digit
+
+	private:
+
+		ShiftDisplay2 &_display;
+		int _section;
+		TimeFormat _format;
+		byte _fields[3]; // time fields in BCD, least significant first
+
+		void setValue(long hours, long minutes, long seconds, long tenths); // wrap fields around their limits and show
+		void step(bool forward); // advance or rewind by one unit of format, in BCD
+		int getDigits(const byte fields[], byte digits[], bool dots[]); // split BCD fields in digits, least significant first, returns quantity
+		void render(); // encode whole time to section cache
+		void render(const byte oldFields[]); // encode only the digits that changed
+
+	public:
+
+		SectionTime(ShiftDisplay2 &display, int section = 0, TimeFormat format = DEFAULT_TIME_FORMAT);
+
+		void setTime(int hours, int minutes, int seconds); // clock time, clear section and show
+		void setDuration(unsigned long milliseconds); // elapsed time, clear section and show
+		void increment(); // one unit of format more
+		void decrement(); // one unit of format less
+};
+
 #endif